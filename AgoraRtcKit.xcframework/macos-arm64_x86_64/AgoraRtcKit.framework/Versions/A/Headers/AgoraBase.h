@@ -4888,8 +4888,17 @@ struct DownlinkNetworkInfo {
           current_downscale_level(REMOTE_VIDEO_DOWNSCALE_LEVEL_NONE),
           expected_bitrate_bps(-1) {}
 
+    PeerDownlinkInfo(const PeerDownlinkInfo& rhs)
+        : uid(OPTIONAL_NULLPTR),
+          stream_type(VIDEO_STREAM_HIGH),
+          current_downscale_level(REMOTE_VIDEO_DOWNSCALE_LEVEL_NONE),
+          expected_bitrate_bps(-1) {
+      *this = rhs;
+    }
+
     PeerDownlinkInfo& operator=(const PeerDownlinkInfo& rhs) {
       if (this == &rhs) return *this;
+      if (uid) { delete [] uid; }
       uid = OPTIONAL_NULLPTR;
       stream_type = rhs.stream_type;
       current_downscale_level = rhs.current_downscale_level;
@@ -4952,10 +4961,16 @@ struct DownlinkNetworkInfo {
     lastmile_buffer_delay_time_ms = rhs.lastmile_buffer_delay_time_ms;
     bandwidth_estimation_bps = rhs.bandwidth_estimation_bps;
     total_downscale_level_count = rhs.total_downscale_level_count;
-    peer_downlink_info = OPTIONAL_NULLPTR;
+    // Reuse the peer array when the peer count is unchanged, which is the common case for
+    // periodic updates.
+    if (peer_downlink_info && total_received_video_count != rhs.total_received_video_count) {
+      delete [] peer_downlink_info;
+      peer_downlink_info = OPTIONAL_NULLPTR;
+    }
     total_received_video_count = rhs.total_received_video_count;
     if (total_received_video_count > 0) {
-      peer_downlink_info = new PeerDownlinkInfo[total_received_video_count];
+      if (!peer_downlink_info)
+        peer_downlink_info = new PeerDownlinkInfo[total_received_video_count];
       for (int i = 0; i < total_received_video_count; ++i)
         peer_downlink_info[i] = rhs.peer_downlink_info[i];
     }
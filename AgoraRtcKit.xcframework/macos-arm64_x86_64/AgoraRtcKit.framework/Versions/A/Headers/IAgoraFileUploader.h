@@ -19,7 +19,10 @@ struct ImagePayloadData {
         size(fileSize),
         width(w),
         height(h),
-        timestamp(ts){
+        timestamp(ts),
+        buffer(pixel),
+        privdata(NULL),
+        privsize(0) {
   }
 
   int seqid;